@@ -0,0 +1,174 @@
+// Measures the phone-side JS: bundle size and time-to-ready under a minimal
+// Node stand-in for the PebbleKit JS runtime.
+//
+//   node scripts/measure-pkjs.js [--config]
+//
+// --config also fires showConfiguration, reports the cost of the lazy load and
+// checks that the Clay instance has its meta filled in before the page opens.
+// Bundle size is read from build/pebble-js-app.js, so run `pebble build` first.
+// If @rebble/clay isn't installed (npm install), a stub takes its place so the
+// ready path can still be timed.
+
+var fs = require('fs');
+var path = require('path');
+var Module = require('module');
+
+var root = path.join(__dirname, '..');
+var pkjsDir = path.join(root, 'src', 'pkjs');
+var entry = path.join(pkjsDir, 'index.js');
+var bundle = path.join(root, 'build', 'pebble-js-app.js');
+
+function fileSize(file) {
+  try {
+    return fs.statSync(file).size;
+  } catch (e) {
+    return 0;
+  }
+}
+
+function kb(bytes) {
+  return (bytes / 1024).toFixed(1) + ' KB';
+}
+
+function ms(start) {
+  var diff = process.hrtime(start);
+  return (diff[0] * 1e3 + diff[1] / 1e6).toFixed(2) + ' ms';
+}
+
+// Bundle size
+
+var ownFiles = fs.readdirSync(pkjsDir).filter(function(name) {
+  return /\.js$/.test(name);
+});
+var clayPath = null;
+try {
+  clayPath = require.resolve('@rebble/clay', { paths: [root] });
+} catch (e) {
+  clayPath = null;
+}
+
+// Lazy requires don't change this: every module is still in the bundle,
+// they're just evaluated later
+console.log('Bundle size');
+if (fs.existsSync(bundle)) {
+  console.log('  build/pebble-js-app.js: ' + kb(fileSize(bundle)));
+} else {
+  console.log('  build/pebble-js-app.js: not built (run pebble build)');
+}
+
+console.log('Source files (unbundled, for reference)');
+var total = 0;
+ownFiles.forEach(function(name) {
+  var size = fileSize(path.join(pkjsDir, name));
+  total += size;
+  console.log('  src/pkjs/' + name + ': ' + kb(size));
+});
+if (clayPath) {
+  var claySize = fileSize(clayPath);
+  total += claySize;
+  console.log('  @rebble/clay entry file: ' + kb(claySize));
+} else {
+  console.log('  @rebble/clay: not installed');
+}
+console.log('  sum: ' + kb(total));
+
+// Stand-in runtime
+
+var listeners = {};
+var storage = {};
+
+global.Pebble = {
+  addEventListener: function(type, fn) {
+    (listeners[type] = listeners[type] || []).push(fn);
+  },
+  sendAppMessage: function(dict, success) {
+    if (success) setTimeout(success, 0);
+  },
+  openURL: function() {},
+  getActiveWatchInfo: function() {
+    return { platform: 'emery', model: 'qemu_platform_emery', language: 'en_US', firmware: { major: 4, minor: 3, patch: 0, suffix: '' } };
+  },
+  getAccountToken: function() { return ''; },
+  getWatchToken: function() { return ''; }
+};
+global.localStorage = {
+  getItem: function(key) { return storage.hasOwnProperty(key) ? storage[key] : null; },
+  setItem: function(key, value) { storage[key] = String(value); },
+  removeItem: function(key) { delete storage[key]; }
+};
+global.navigator = {
+  geolocation: {
+    getCurrentPosition: function(success, failure) {
+      failure({ message: 'no location in stand-in runtime' });
+    }
+  }
+};
+
+// Like Clay, the stub starts with empty meta; it is only filled by Clay's own
+// 'ready' listener, so a lazily built instance has to fill it by hand
+function ClayStub() {
+  this.meta = { activeWatchInfo: null, accountToken: '', watchToken: '', userData: {} };
+  this.generateUrl = function() { return 'data:text/html,'; };
+  this.getSettings = function() { return {}; };
+}
+
+// Wrap the Clay constructor so the instance built by index.js can be inspected
+var clayInstances = [];
+var originalLoad = Module._load;
+Module._load = function(request) {
+  if (request !== '@rebble/clay') {
+    return originalLoad.apply(this, arguments);
+  }
+  var Clay = clayPath ? originalLoad.apply(this, arguments) : ClayStub;
+  var Wrapped = function(config, customFn, options) {
+    var instance = new Clay(config, customFn, options);
+    clayInstances.push(instance);
+    return instance;
+  };
+  Object.keys(Clay).forEach(function(key) {
+    Wrapped[key] = Clay[key];
+  });
+  return Wrapped;
+};
+
+function emit(type, event) {
+  (listeners[type] || []).forEach(function(fn) {
+    fn(event || {});
+  });
+}
+
+function loadedModules() {
+  return Object.keys(require.cache).filter(function(file) {
+    return file !== __filename;
+  }).map(function(file) {
+    return path.relative(root, file);
+  });
+}
+
+var start = process.hrtime();
+require(entry);
+var evaluated = ms(start);
+emit('ready');
+var ready = ms(start);
+
+console.log('Time to ready');
+console.log('  evaluate index.js: ' + evaluated);
+console.log('  ready handlers done: ' + ready);
+console.log('  modules loaded: ' + loadedModules().join(', '));
+
+if (process.argv.indexOf('--config') !== -1) {
+  var configStart = process.hrtime();
+  emit('showConfiguration');
+  console.log('showConfiguration');
+  console.log('  handler done: ' + ms(configStart));
+  console.log('  modules loaded: ' + loadedModules().join(', '));
+
+  var meta = clayInstances.length ? clayInstances[0].meta : null;
+  console.log('  meta.activeWatchInfo: ' + (meta && meta.activeWatchInfo ? meta.activeWatchInfo.platform : 'missing'));
+  console.log('  meta.userData: ' + (meta && meta.userData ? Object.keys(meta.userData).join(', ') || 'empty' : 'missing'));
+}
+
+// The weather interval would otherwise keep the process alive
+setTimeout(function() {
+  process.exit(0);
+}, 50);
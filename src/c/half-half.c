@@ -3,6 +3,7 @@
 // Forward declarations
 static void update_colors();
 static void update_time();
+static void update_weather();
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed);
 static void disable_seconds_callback(void *data);
 
@@ -22,6 +23,7 @@ static TextLayer *s_battery_name_layer;
 static TextLayer *s_step_value_layer;
 #endif
 static TextLayer *s_battery_value_layer;
+static TextLayer *s_weather_layer;
 
 //settings
 static GColor s_background_color;
@@ -31,6 +33,16 @@ static bool s_battery_save_enabled;
 static bool s_show_seconds;
 static bool s_show_leading_zero;
 static bool s_use_text_color_override;
+static bool s_show_weather;
+
+// Last weather pushed by the phone: temperature in the low byte (signed),
+// condition in the next byte, plus when it arrived
+typedef struct {
+  int32_t packed;
+  time_t received;
+} WeatherData;
+
+static WeatherData s_weather;
 
 // Unobstructed area tracking
 static GRect s_full_bounds;
@@ -58,12 +70,16 @@ static char s_second_buffer[4];
 static char s_step_buffer[8];
 #endif
 static char s_battery_buffer[8];
+static char s_weather_buffer[16];
 
 static bool s_is_focused = true;
 static AppTimer *s_seconds_timer = NULL;
 static bool is_large_screen = false;
 
 #define SECONDS_DISPLAY_DURATION 10000  // Show seconds for 10 seconds after interaction
+// The phone refreshes weather every 30 minutes and re-sends it at least hourly,
+// so anything older than three refresh periods means the phone is out of reach
+#define WEATHER_STALE_SECONDS (90 * 60)
 
 // Helper to interpolate a GRect based on animation progress
 static GRect prv_get_animated_frame(GRect full_frame, int full_height, int current_height, AnimationProgress progress) {
@@ -99,6 +115,9 @@ static void prv_update_layer_positions(AnimationProgress progress) {
   if (s_show_seconds) {
     layer_set_hidden(text_layer_get_layer(s_second_layer), is_obstructed);
   }
+
+  // Hide weather when obstructed, the hour moves up into its space
+  layer_set_hidden(text_layer_get_layer(s_weather_layer), !s_show_weather || is_obstructed);
   
   // Calculate offset for hour to move it up a bit when obstructed
   GRect hour_frame = prv_get_animated_frame(s_hour_frame_full, full_h, current_h, progress);
@@ -154,6 +173,10 @@ static void load_settings() {
   s_show_leading_zero = persist_exists(MESSAGE_KEY_SHOW_LEADING_ZERO) ? persist_read_bool(MESSAGE_KEY_SHOW_LEADING_ZERO) : false;
   s_use_text_color_override = persist_exists(MESSAGE_KEY_USE_TEXT_COLOR_OVERRIDE) ? persist_read_bool(MESSAGE_KEY_USE_TEXT_COLOR_OVERRIDE) : false;
   s_text_override_color = persist_exists(MESSAGE_KEY_TEXT_OVERRIDE_COLOR) ? (GColor){ .argb = (uint8_t)persist_read_int(MESSAGE_KEY_TEXT_OVERRIDE_COLOR) } : GColorWhite;
+  s_show_weather = persist_exists(MESSAGE_KEY_SHOW_WEATHER) ? persist_read_bool(MESSAGE_KEY_SHOW_WEATHER) : false;
+  if (persist_read_data(MESSAGE_KEY_WEATHER, &s_weather, sizeof(s_weather)) != sizeof(s_weather)) {
+    s_weather = (WeatherData){ .packed = 0, .received = 0 };
+  }
 }
 
 // Save settings
@@ -165,10 +188,21 @@ static void save_settings() {
   persist_write_bool(MESSAGE_KEY_SHOW_LEADING_ZERO, s_show_leading_zero);
   persist_write_bool(MESSAGE_KEY_USE_TEXT_COLOR_OVERRIDE, s_use_text_color_override);
   persist_write_int(MESSAGE_KEY_TEXT_OVERRIDE_COLOR, s_text_override_color.argb);
+  persist_write_bool(MESSAGE_KEY_SHOW_WEATHER, s_show_weather);
 }
 
 // Inbox received callback
 static void inbox_received_callback(DictionaryIterator *iterator, void *context) {
+
+  // Weather arrives on its own, so don't rewrite the settings for it
+  Tuple *weather_tuple = dict_find(iterator, MESSAGE_KEY_WEATHER);
+  if (weather_tuple) {
+    s_weather.packed = weather_tuple->value->int32;
+    s_weather.received = time(NULL);
+    persist_write_data(MESSAGE_KEY_WEATHER, &s_weather, sizeof(s_weather));
+    update_weather();
+    return;
+  }
  
   Tuple *bgcolor_tuple = dict_find(iterator, MESSAGE_KEY_PRIMARY_COLOR);
   if (bgcolor_tuple) {
@@ -259,12 +293,24 @@ static void inbox_received_callback(DictionaryIterator *iterator, void *context)
     s_text_override_color = GColorFromHEX(text_override_color_tuple->value->int32);
   }
 
+  Tuple *show_weather_tuple = dict_find(iterator, MESSAGE_KEY_SHOW_WEATHER);
+  if (show_weather_tuple) {
+    s_show_weather = show_weather_tuple->value->int32 == 1;
+    GRect unobstructed = layer_get_unobstructed_bounds(window_get_root_layer(s_main_window));
+    bool is_obstructed = unobstructed.size.h < s_full_bounds.size.h;
+    layer_set_hidden(text_layer_get_layer(s_weather_layer), !s_show_weather || is_obstructed);
+    if (s_show_weather) {
+      update_weather();
+    }
+  }
+
   save_settings();
   update_colors();
   layer_mark_dirty(s_canvas_layer);
   
 }
 
+// Geometry here and in main_window_load is mirrored by src/pkjs/preview-layout.js
 static void canvas_update_proc(Layer *layer, GContext *ctx) {
   GRect bounds = layer_get_bounds(layer);
   GRect unobstructed = layer_get_unobstructed_bounds(window_get_root_layer(s_main_window));
@@ -310,6 +356,7 @@ static void update_colors() {
     text_layer_set_text_color(s_step_value_layer, s_text_override_color);
 #endif
     text_layer_set_text_color(s_battery_value_layer, s_text_override_color);
+    text_layer_set_text_color(s_weather_layer, s_text_override_color);
     return;
   }
 
@@ -326,6 +373,7 @@ static void update_colors() {
   text_layer_set_text_color(s_step_value_layer, s_accent_color);
 #endif
   text_layer_set_text_color(s_battery_value_layer, s_accent_color);
+  text_layer_set_text_color(s_weather_layer, s_background_color);
 }
 
 static void update_time() {
@@ -370,6 +418,26 @@ static void update_time() {
   text_layer_set_text(s_battery_name_layer, "Batt");
 }
 
+static void update_weather() {
+  static const char *const conditions[] = { "", "Clear", "Cloudy", "Fog", "Rain", "Snow", "Storm" };
+
+  if (s_weather.received == 0) {
+    text_layer_set_text(s_weather_layer, "--");
+    return;
+  }
+
+  int temperature = (int8_t)(s_weather.packed & 0xFF);
+  unsigned int condition = (s_weather.packed >> 8) & 0xFF;
+  if (condition >= ARRAY_LENGTH(conditions)) {
+    condition = 0;
+  }
+  bool is_stale = time(NULL) - s_weather.received > WEATHER_STALE_SECONDS;
+
+  snprintf(s_weather_buffer, sizeof(s_weather_buffer), "%d\xC2\xB0 %s%s",
+    temperature, conditions[condition], is_stale ? "*" : "");
+  text_layer_set_text(s_weather_layer, s_weather_buffer);
+}
+
 static void update_battery(BatteryChargeState charge_state) {
   snprintf(s_battery_buffer, sizeof(s_battery_buffer), "%d%%", charge_state.charge_percent);
   text_layer_set_text(s_battery_value_layer, s_battery_buffer);
@@ -400,6 +468,11 @@ static void health_handler(HealthEventType event, void *context) {
 
 static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
   update_time();
+
+  // Staleness only changes on the order of minutes
+  if (s_show_weather && (units_changed & MINUTE_UNIT)) {
+    update_weather();
+  }
 }
 
 static void disable_seconds_callback(void *data) {
@@ -643,6 +716,15 @@ static void main_window_load(Window *window) {
   text_layer_set_font(s_battery_value_layer, fonts_get_system_font(is_large_screen ? FONT_KEY_GOTHIC_18_BOLD : FONT_KEY_GOTHIC_14_BOLD));
   text_layer_set_text_alignment(s_battery_value_layer, GTextAlignmentCenter);
   layer_add_child(window_layer, text_layer_get_layer(s_battery_value_layer));
+
+  // Weather layer - small text along the top edge, above the hour
+  s_weather_layer = text_layer_create(GRect(0, PBL_IF_ROUND_ELSE(6, 0), bounds.size.w, is_large_screen ? 24 : 18));
+  text_layer_set_background_color(s_weather_layer, GColorClear);
+  text_layer_set_text_color(s_weather_layer, s_background_color);
+  text_layer_set_font(s_weather_layer, fonts_get_system_font(is_large_screen ? FONT_KEY_GOTHIC_18_BOLD : FONT_KEY_GOTHIC_14_BOLD));
+  text_layer_set_text_alignment(s_weather_layer, GTextAlignmentCenter);
+  layer_set_hidden(text_layer_get_layer(s_weather_layer), !s_show_weather);
+  layer_add_child(window_layer, text_layer_get_layer(s_weather_layer));
   
   // Store original frames for unobstructed area animation
   s_hour_frame_full = layer_get_frame(text_layer_get_layer(s_hour_layer));
@@ -680,6 +762,7 @@ static void main_window_unload(Window *window) {
   text_layer_destroy(s_step_value_layer);
 #endif
   text_layer_destroy(s_battery_value_layer);
+  text_layer_destroy(s_weather_layer);
   layer_destroy(s_canvas_layer);
 }
 
@@ -740,6 +823,7 @@ static void init() {
 #if defined(PBL_HEALTH)
   update_steps();
 #endif
+  update_weather();
 
   // Start timer to automatically disable seconds after initial display only if battery saving and seconds are enabled
   if (s_battery_save_enabled && s_show_seconds) {
@@ -95,6 +95,28 @@ module.exports = [
       }
     ]
   },
+  {
+    "type": "section",
+    "items": [
+      {
+        "type": "heading",
+        "defaultValue": "Weather"
+      },
+      {
+        "type": "toggle",
+        "messageKey": "SHOW_WEATHER",
+        "label": "Show Weather",
+        "description": "Current temperature and condition at the top of the screen. Updated at most every 30 minutes; marked with * when out of date.",
+        "defaultValue": false,
+      },
+      {
+        "type": "toggle",
+        "messageKey": "WEATHER_FAHRENHEIT",
+        "label": "Use Fahrenheit",
+        "defaultValue": false,
+      }
+    ]
+  },
   {
     "type": "submit",
     "defaultValue": "Save Settings"
@@ -22,6 +22,15 @@ module.exports = function(minified) {
     }
   }
 
+  function toggleWeatherUnits() {
+    var weatherFahrenheitToggle = clayConfig.getItemByMessageKey('WEATHER_FAHRENHEIT');
+    if (this.get()) {
+      weatherFahrenheitToggle.enable();
+    } else {
+      weatherFahrenheitToggle.disable();
+    }
+  }
+
   function RGBtoHex(rgb) {
     return '#' + ((1 << 24) + (rgb[0] << 16) + (rgb[1] << 8) + rgb[2]).toString(16).slice(1).toUpperCase();
   }
@@ -47,75 +56,128 @@ module.exports = function(minified) {
     { name: 'Slate',   upper: '555555', lower: 'FFFFFF', text: null },
   ];
 
+  function createElement(tag, style, text) {
+    var element = document.createElement(tag);
+    element.style.cssText = style;
+    if (text) {
+      element.textContent = text;
+    }
+    return element;
+  }
+
   function buildPresets() {
-    var presetsItem = clayConfig.getItemById('COLOR_PRESETS');
     var primaryColorItem = clayConfig.getItemByMessageKey('PRIMARY_COLOR');
     var secondaryColorItem = clayConfig.getItemByMessageKey('SECONDARY_COLOR');
+    var textColorOverrideItem = clayConfig.getItemByMessageKey('USE_TEXT_COLOR_OVERRIDE');
     var textOverrideColorItem = clayConfig.getItemByMessageKey('TEXT_OVERRIDE_COLOR');
 
-    var html = '<div id="hh-presets" style="display:flex;flex-wrap:nowrap;overflow-x:auto;gap:6px;padding:4px 0;-webkit-overflow-scrolling:touch;">';
+    clayConfig.getItemById('COLOR_PRESETS').set('<div id="hh-presets" style="display:flex;flex-wrap:nowrap;overflow-x:auto;gap:6px;padding:4px 0;-webkit-overflow-scrolling:touch;"></div>');
+    var container = document.getElementById('hh-presets');
+
     PRESETS.forEach(function(p) {
-      html += '<button type=\"button\" data-upper=\"' + p.upper + '\"' +
-        ' data-lower=\"' + p.lower + '\"' +
-        (p.text ? ' data-text=\"' + p.text + '\"' : '') +
-        ' style="border:2px solid #ccc;border-radius:6px;padding:0;width:40px;cursor:pointer;overflow:hidden;background:none;">' +
-        '<div style="height:20px;background:#' + p.upper + ';"></div>' +
-        '<div style="height:20px;background:#' + p.lower + ';"></div>' +
-        '<div style="font-size:14px;font-weight:bold;padding:2px 0;text-align:center;background:#' + p.upper + ';color:#' +  (p.text || p.lower) + ';">' + p.name + '</div>' +
-        '</button>';
-    });
-    html += '</div>';
-
-    presetsItem.set(html);
-
-    document.querySelectorAll('#hh-presets button').forEach(function(btn) {
-      btn.addEventListener('click', function() {
-        secondaryColorItem.set(parseInt(btn.getAttribute('data-upper'), 16));
-        primaryColorItem.set(parseInt(btn.getAttribute('data-lower'), 16));
-        if (btn.hasAttribute('data-text')) {
-          clayConfig.getItemByMessageKey('USE_TEXT_COLOR_OVERRIDE').set(true);
-          textOverrideColorItem.set(parseInt(btn.getAttribute('data-text'), 16));
-        } else {         
-          clayConfig.getItemByMessageKey('USE_TEXT_COLOR_OVERRIDE').set(false);
+      var button = createElement('button', 'border:2px solid #ccc;border-radius:6px;padding:0;width:40px;cursor:pointer;overflow:hidden;background:none;');
+      button.type = 'button';
+      button.appendChild(createElement('div', 'height:20px;background:#' + p.upper + ';'));
+      button.appendChild(createElement('div', 'height:20px;background:#' + p.lower + ';'));
+      button.appendChild(createElement('div', 'font-size:14px;font-weight:bold;padding:2px 0;text-align:center;background:#' + p.upper + ';color:#' + (p.text || p.lower) + ';', p.name));
+
+      // Each set() fires a change event; the preview coalesces them into one repaint
+      button.addEventListener('click', function() {
+        secondaryColorItem.set(parseInt(p.upper, 16));
+        primaryColorItem.set(parseInt(p.lower, 16));
+        if (p.text) {
+          textColorOverrideItem.set(true);
+          textOverrideColorItem.set(parseInt(p.text, 16));
+        } else {
+          textColorOverrideItem.set(false);
         }
       });
+      container.appendChild(button);
     });
   }
 
-  function togglePreview() {
-    var preview = clayConfig.getItemById('PREVIEW');
-    var primaryColor = decimalToRGB(clayConfig.getItemByMessageKey('PRIMARY_COLOR').get());
-    var secondaryColor = decimalToRGB(clayConfig.getItemByMessageKey('SECONDARY_COLOR').get());
-    var textColorOverrideToggle = clayConfig.getItemByMessageKey('USE_TEXT_COLOR_OVERRIDE');
-    var textOverrideColor = decimalToRGB(clayConfig.getItemByMessageKey('TEXT_OVERRIDE_COLOR').get());
+  // Preview elements grouped by the value that drives them. A repaint only
+  // touches the groups whose value changed since the last one.
+  var previewGroups = {};
+  var previewApplied = {};
+  var previewPending = false;
 
-    var topTextColor = textColorOverrideToggle.get() ? textOverrideColor : primaryColor;
-    var bottomTextColor = textColorOverrideToggle.get() ? textOverrideColor : secondaryColor;
+  function addToPreviewGroup(key, property, element) {
+    var group = previewGroups[key] || (previewGroups[key] = { property: property, elements: [] });
+    group.elements.push(element);
+  }
 
-    var previewHTML = '' +
-      '<div style="width:200px;height:228px;margin:0 auto;position:relative;font-family:\'Avenir Next Condensed\',\'Arial Narrow\',sans-serif;overflow:hidden;background:' + primaryColor + ';">' +
-        '<div style="position:absolute;left:0;right:0;top:0;height:114px;background:' + secondaryColor + ';"></div>' +
-        '<div style="position:absolute;left:0;right:0;top:114px;height:114px;background:' + primaryColor + ';"></div>' +
+  // Builds the preview DOM once from the layout computed on the phone
+  // (src/pkjs/preview-layout.js), which mirrors main_window_load
+  function buildPreview(layout) {
+    clayConfig.getItemById('PREVIEW').set('<div id="hh-preview"></div>');
+
+    var screen = createElement('div', 'width:' + layout.width + 'px;height:' + layout.height + 'px;margin:0 auto;position:relative;overflow:hidden;' +
+      'font-family:\'Avenir Next Condensed\',\'Arial Narrow\',sans-serif;font-weight:700;' +
+      (layout.round ? 'border-radius:50%;' : ''));
+
+    layout.shapes.forEach(function(shape) {
+      var element = shape.type === 'circle' ?
+        createElement('div', 'position:absolute;border-radius:50%;left:' + (shape.cx - shape.r) + 'px;top:' + (shape.cy - shape.r) + 'px;width:' + (shape.r * 2) + 'px;height:' + (shape.r * 2) + 'px;') :
+        createElement('div', 'position:absolute;left:' + shape.x + 'px;top:' + shape.y + 'px;width:' + shape.w + 'px;height:' + shape.h + 'px;');
+      addToPreviewGroup('fill-' + shape.fill, 'backgroundColor', element);
+      screen.appendChild(element);
+    });
 
-        '<div style="position:absolute;top:18px;left:0;right:0;text-align:center;font-size:60px;font-weight:700;line-height:1;color:' + topTextColor + ';">8</div>' +
+    layout.texts.forEach(function(text) {
+      var element = createElement('div', 'position:absolute;left:' + text.x + 'px;top:' + text.y + 'px;width:' + text.w + 'px;height:' + text.h + 'px;' +
+        'font-size:' + text.size + 'px;line-height:1;text-align:center;white-space:nowrap;', text.sample);
+      addToPreviewGroup('text-' + text.color, 'color', element);
+      if (text.toggle) {
+        addToPreviewGroup('show-' + text.toggle, 'display', element);
+      }
+      screen.appendChild(element);
+    });
 
-        '<div style="position:absolute;left:0;right:0;top:90px;height:28px;font-size:18px;font-weight:700;line-height:1;">' +
-          '<span style="position:absolute;left:10px;top:0;color:' + topTextColor + ';">Steps</span>' +
-          '<span style="position:absolute;right:10px;top:0;color:' + topTextColor + ';">Batt</span>' +
-          '<span style="position:absolute;left:24px;top:35px;color:' + bottomTextColor + ';">0</span>' +
-          '<span style="position:absolute;right:8px;top:35px;color:' + bottomTextColor + ';">80%</span>' +
-        '</div>' +
+    document.getElementById('hh-preview').appendChild(screen);
+  }
 
-        '<div style="font-size: 18px; line-height: 1.05; position: absolute; background-color: ' + secondaryColor + ';color:' + topTextColor + '; border-radius: 50%; width: 40px; height: 40px; display: flex; align-items: center; justify-content: center; top: 94px; left: 60px;font-weight: bold;">APR</div>' +
-        '<div style="font-size: 18px; line-height: 1.05; position: absolute; background-color: ' + primaryColor + ';color:' + bottomTextColor + '; border-radius: 50%; width: 40px; height: 40px; display: flex; align-items: center; justify-content: center; top: 94px; left: 100px;font-weight: bold;">26</div>' +
+  function readPreviewState() {
+    var accent = decimalToRGB(clayConfig.getItemByMessageKey('SECONDARY_COLOR').get());
+    var background = decimalToRGB(clayConfig.getItemByMessageKey('PRIMARY_COLOR').get());
+    var useOverride = clayConfig.getItemByMessageKey('USE_TEXT_COLOR_OVERRIDE').get();
+    var override = decimalToRGB(clayConfig.getItemByMessageKey('TEXT_OVERRIDE_COLOR').get());
+
+    return {
+      'fill-accent': accent,
+      'fill-background': background,
+      'text-accent': useOverride ? override : accent,
+      'text-background': useOverride ? override : background,
+      'show-SHOW_SECONDS': clayConfig.getItemByMessageKey('SHOW_SECONDS').get() ? '' : 'none',
+      'show-SHOW_WEATHER': clayConfig.getItemByMessageKey('SHOW_WEATHER').get() ? '' : 'none'
+    };
+  }
 
-        '<div style="position:absolute;left:0;right:0;top:138px;color:' + bottomTextColor + ';text-align:center;font-weight:700;">' +
-          '<div style="font-size:60px;line-height:0.95;">34</div>' +
-          '<div style="font-size:32px;line-height:0.88;">33</div>' +
-        '</div>' +
-      '</div>';
+  function repaintPreview() {
+    previewPending = false;
+    var state = readPreviewState();
+    Object.keys(previewGroups).forEach(function(key) {
+      if (state[key] === previewApplied[key]) {
+        return;
+      }
+      var group = previewGroups[key];
+      group.elements.forEach(function(element) {
+        element.style[group.property] = state[key];
+      });
+      previewApplied[key] = state[key];
+    });
+  }
 
-    preview.set(previewHTML);
+  function schedulePreviewRepaint() {
+    if (previewPending) {
+      return;
+    }
+    previewPending = true;
+    if (window.requestAnimationFrame) {
+      window.requestAnimationFrame(repaintPreview);
+    } else {
+      setTimeout(repaintPreview, 0);
+    }
   }
 
   clayConfig.on(clayConfig.EVENTS.AFTER_BUILD, function() {
@@ -129,14 +191,22 @@ module.exports = function(minified) {
     toggleTextColorOverride.call(textColorOverrideToggle);
     textColorOverrideToggle.on('change', toggleTextColorOverride);
 
-    var primaryColor = clayConfig.getItemByMessageKey('PRIMARY_COLOR');
-    var secondaryColor = clayConfig.getItemByMessageKey('SECONDARY_COLOR');
-    var textOverrideColor = clayConfig.getItemByMessageKey('TEXT_OVERRIDE_COLOR');
+    var showWeatherToggle = clayConfig.getItemByMessageKey('SHOW_WEATHER');
+    toggleWeatherUnits.call(showWeatherToggle);
+    showWeatherToggle.on('change', toggleWeatherUnits);
 
-    togglePreview.call(primaryColor);
-    textColorOverrideToggle.on('change', togglePreview);
-    primaryColor.on('change', togglePreview);
-    secondaryColor.on('change', togglePreview);
-    textOverrideColor.on('change', togglePreview);
+    // The layout comes from the phone through meta.userData (see index.js)
+    var layout = clayConfig.meta && clayConfig.meta.userData && clayConfig.meta.userData.previewLayout;
+    if (!layout) {
+      console.log('Half/Half: no preview layout in meta.userData, preview disabled');
+      clayConfig.getItemById('PREVIEW').set('Preview unavailable');
+      return;
+    }
+
+    buildPreview(layout);
+    repaintPreview();
+    ['PRIMARY_COLOR', 'SECONDARY_COLOR', 'TEXT_OVERRIDE_COLOR', 'USE_TEXT_COLOR_OVERRIDE', 'SHOW_SECONDS', 'SHOW_WEATHER'].forEach(function(messageKey) {
+      clayConfig.getItemByMessageKey(messageKey).on('change', schedulePreviewRepaint);
+    });
   });
 };
\ No newline at end of file
@@ -1,4 +1,51 @@
-var Clay = require('@rebble/clay');
-var clayConfig = require('./config');
-var customClay = require('./custom-clay');
-var clay = new Clay(clayConfig, customClay);
+var weather = require('./weather');
+
+// Clay and the config modules are only needed while the settings page is open,
+// so they are required on first use instead of at startup
+var clay = null;
+
+function getClay() {
+  if (!clay) {
+    var Clay = require('@rebble/clay');
+    var clayConfig = require('./config');
+    var customClay = require('./custom-clay');
+    var previewLayout = require('./preview-layout');
+    var watch = Pebble.getActiveWatchInfo ? Pebble.getActiveWatchInfo() : null;
+    var userData = { previewLayout: previewLayout(watch ? watch.platform : 'basalt') };
+    clay = new Clay(clayConfig, customClay, {
+      autoHandleEvents: false,
+      userData: userData
+    });
+
+    // Clay fills meta from its own 'ready' listener, which has already fired
+    // by the time it is built here, so do the same by hand
+    clay.meta = {
+      activeWatchInfo: watch,
+      accountToken: Pebble.getAccountToken(),
+      watchToken: Pebble.getWatchToken(),
+      userData: userData
+    };
+  }
+  return clay;
+}
+
+Pebble.addEventListener('ready', function() {
+  weather.start();
+});
+
+Pebble.addEventListener('showConfiguration', function() {
+  Pebble.openURL(getClay().generateUrl());
+});
+
+Pebble.addEventListener('webviewclosed', function(e) {
+  if (!e || !e.response) {
+    return;
+  }
+
+  Pebble.sendAppMessage(getClay().getSettings(e.response), function() {
+    // Settings may have turned weather on or switched units
+    weather.refresh();
+  }, function(error) {
+    console.log('Failed to send settings: ' + JSON.stringify(error));
+  });
+});
\ No newline at end of file
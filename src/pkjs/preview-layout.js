@@ -0,0 +1,83 @@
+// Per-platform geometry of the watchface, used by the settings preview.
+// Mirrors canvas_update_proc and main_window_load in src/c/half-half.c;
+// keep the two in sync.
+//
+// Fills and text colors are given as roles: 'accent' is the upper color
+// (SECONDARY_COLOR), 'background' the lower one (PRIMARY_COLOR). Items with a
+// toggle are only shown while that setting is on.
+
+var SCREENS = {
+  aplite:  { width: 144, height: 168, round: false, large: false, health: false },
+  basalt:  { width: 144, height: 168, round: false, large: false, health: true },
+  chalk:   { width: 180, height: 180, round: true,  large: false, health: true },
+  diorite: { width: 144, height: 168, round: false, large: false, health: true },
+  emery:   { width: 200, height: 228, round: false, large: true,  health: true },
+  flint:   { width: 144, height: 168, round: false, large: false, health: true },
+  gabbro:  { width: 260, height: 260, round: true,  large: true,  health: true }
+};
+
+module.exports = function(platform) {
+  var screen = SCREENS[platform] || SCREENS.basalt;
+  var w = screen.width;
+  var h = screen.height;
+  var large = screen.large;
+  var half = Math.floor(h / 2);
+  var cx = Math.floor(w / 2);
+
+  var shapes = [];
+  var texts = [];
+
+  function text(x, y, width, height, size, color, sample, toggle) {
+    texts.push({ x: x, y: y, w: width, h: height, size: size, color: color, sample: sample, toggle: toggle || null });
+  }
+
+  // canvas_update_proc
+  var circleRadius = large ? 22 : 15;
+  var circleSpacing = large ? 22 : 15;
+  shapes.push({ type: 'rect', x: 0, y: 0, w: w, h: half, fill: 'accent' });
+  shapes.push({ type: 'rect', x: 0, y: half, w: w, h: h - half, fill: 'background' });
+  shapes.push({ type: 'circle', cx: cx - circleSpacing, cy: half, r: circleRadius, fill: 'background' });
+  shapes.push({ type: 'circle', cx: cx + circleSpacing + 1, cy: half, r: circleRadius, fill: 'accent' });
+
+  // main_window_load
+  var timeSize = large ? 60 : 42;
+  var infoSize = large ? 18 : 14;
+  var hourOffset = large ? 105 : 70;
+  var minuteOffset = large ? 15 : 12;
+  text(0, half - hourOffset, w, hourOffset, timeSize, 'background', '8');
+  text(0, half + minuteOffset, w, 70, timeSize, 'accent', '34');
+
+  var secondsHeight = platform === 'gabbro' ? 50 : (large ? 40 : 30);
+  text(0, h - secondsHeight, w, secondsHeight, large ? 32 : 20, 'accent', '33', 'SHOW_SECONDS');
+
+  var dateSpacing = large ? 20 : 13;
+  var dateWidth = large ? 40 : 30;
+  var dateHeight = large ? 30 : 26;
+  var dateOffset = large ? 13 : 10;
+  text(cx - dateSpacing - dateWidth / 2 - 1, half - dateOffset, dateWidth, dateHeight, infoSize, 'accent', 'APR');
+  text(cx + dateSpacing - dateWidth / 2 + 1, half - dateOffset, dateWidth, dateHeight, infoSize, 'background', '26');
+
+  var topOffset = large ? 8 : 4;
+
+  if (screen.health) {
+    var stepX = large ? 3 : (screen.round ? 10 : 0);
+    var stepWidth = large ? 50 : 40;
+    text(stepX, half - topOffset - 18, stepWidth, 30, infoSize, 'background', 'Steps');
+    text(stepX, half + topOffset, stepWidth, 24, infoSize, 'accent', '0');
+  }
+
+  var battX = large ? w - 53 : (screen.round ? w - 50 : w - 40);
+  var battWidth = large ? 50 : 40;
+  text(battX, half - topOffset - 18, battWidth, 30, infoSize, 'background', 'Batt');
+  text(battX, half + 2, battWidth, 24, infoSize, 'accent', '80%');
+
+  text(0, screen.round ? 6 : 0, w, large ? 24 : 18, infoSize, 'background', '21° Clear', 'SHOW_WEATHER');
+
+  return {
+    width: w,
+    height: h,
+    round: screen.round,
+    shapes: shapes,
+    texts: texts
+  };
+};
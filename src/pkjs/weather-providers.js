@@ -0,0 +1,80 @@
+// Weather providers. Each provider fetches the current conditions and calls
+// back with (err, { celsius: Number, condition: CONDITIONS.* }).
+// Providers that don't need the phone's position set needsLocation to false.
+
+var CONDITIONS = {
+  UNKNOWN: 0,
+  CLEAR: 1,
+  CLOUDY: 2,
+  FOG: 3,
+  RAIN: 4,
+  SNOW: 5,
+  STORM: 6
+};
+
+// Map WMO weather interpretation codes to our condition set
+function conditionFromWmo(code) {
+  if (code === 0 || code === 1) return CONDITIONS.CLEAR;
+  if (code === 2 || code === 3) return CONDITIONS.CLOUDY;
+  if (code === 45 || code === 48) return CONDITIONS.FOG;
+  if ((code >= 51 && code <= 67) || (code >= 80 && code <= 82)) return CONDITIONS.RAIN;
+  if ((code >= 71 && code <= 77) || code === 85 || code === 86) return CONDITIONS.SNOW;
+  if (code >= 95 && code <= 99) return CONDITIONS.STORM;
+  return CONDITIONS.UNKNOWN;
+}
+
+var openMeteo = {
+  needsLocation: true,
+  fetch: function(coords, callback) {
+    var url = 'https://api.open-meteo.com/v1/forecast' +
+      '?latitude=' + coords.latitude.toFixed(2) +
+      '&longitude=' + coords.longitude.toFixed(2) +
+      '&current=temperature_2m,weather_code';
+
+    var xhr = new XMLHttpRequest();
+    xhr.onload = function() {
+      var data;
+      try {
+        data = JSON.parse(this.responseText);
+      } catch (e) {
+        callback(new Error('open-meteo: invalid response'));
+        return;
+      }
+      if (!data || !data.current) {
+        callback(new Error('open-meteo: missing current conditions'));
+        return;
+      }
+      callback(null, {
+        celsius: data.current.temperature_2m,
+        condition: conditionFromWmo(data.current.weather_code)
+      });
+    };
+    xhr.onerror = function() {
+      callback(new Error('open-meteo: request failed'));
+    };
+    xhr.open('GET', url);
+    xhr.send();
+  }
+};
+
+// Offline stand-in for testing the watch side without network or location
+// access; used automatically on the emulator (see getProvider in weather.js).
+// Walks through every condition on each fetch.
+var stubCounter = 0;
+var stub = {
+  needsLocation: false,
+  fetch: function(coords, callback) {
+    var condition = (stubCounter % 6) + 1;
+    var celsius = -5 + (stubCounter * 7) % 40;
+    stubCounter++;
+    setTimeout(function() {
+      callback(null, { celsius: celsius, condition: condition });
+    }, 0);
+  }
+};
+
+module.exports = {
+  CONDITIONS: CONDITIONS,
+  'open-meteo': openMeteo,
+  'stub': stub
+};
@@ -0,0 +1,135 @@
+var providers = require('./weather-providers');
+
+// Fetched conditions are reused for this long before asking the provider again
+var TTL_MS = 30 * 60 * 1000;
+// Re-send an unchanged value after this long so the watch never marks it stale.
+// Keep below WEATHER_STALE_SECONDS in half-half.c (3 * TTL).
+var RESEND_MS = 2 * TTL_MS;
+// Timer ticks and network round trips drift by a few seconds, so ages within
+// this margin of a limit count as having reached it
+var MARGIN_MS = 60 * 1000;
+var RETRY_MS = 2000;
+
+var DEFAULT_PROVIDER = 'open-meteo';
+// Set to a name from weather-providers.js (e.g. 'stub') to force a provider;
+// otherwise the emulator uses the stub and watches use DEFAULT_PROVIDER
+var PROVIDER = null;
+var CACHE_KEY = 'weather-cache';
+var SENT_KEY = 'weather-sent';
+
+var s_timer = null;
+
+function readJSON(key) {
+  try {
+    return JSON.parse(localStorage.getItem(key));
+  } catch (e) {
+    return null;
+  }
+}
+
+function writeJSON(key, value) {
+  localStorage.setItem(key, JSON.stringify(value));
+}
+
+// Clay keeps the saved settings in localStorage, keyed by messageKey
+function readSettings() {
+  return readJSON('clay-settings') || {};
+}
+
+function isEmulator() {
+  var watch = Pebble.getActiveWatchInfo ? Pebble.getActiveWatchInfo() : null;
+  return !!(watch && watch.model && watch.model.indexOf('qemu') === 0);
+}
+
+function getProvider() {
+  var name = PROVIDER || (isEmulator() ? 'stub' : DEFAULT_PROVIDER);
+  return providers[name] || providers[DEFAULT_PROVIDER];
+}
+
+// Temperature in the low byte (signed), condition in the next byte
+function pack(cache, fahrenheit) {
+  var temp = fahrenheit ? cache.celsius * 9 / 5 + 32 : cache.celsius;
+  temp = Math.max(-128, Math.min(127, Math.round(temp)));
+  return ((cache.condition & 0xFF) << 8) | (temp & 0xFF);
+}
+
+function push(cache, retries) {
+  var settings = readSettings();
+  var packed = pack(cache, !!settings.WEATHER_FAHRENHEIT);
+  var sent = readJSON(SENT_KEY);
+  var now = Date.now();
+
+  if (sent && sent.packed === packed && now - sent.sentAt < RESEND_MS - MARGIN_MS) {
+    return;
+  }
+
+  Pebble.sendAppMessage({ 'WEATHER': packed }, function() {
+    writeJSON(SENT_KEY, { packed: packed, sentAt: now });
+  }, function() {
+    if (retries > 0) {
+      setTimeout(function() { push(cache, retries - 1); }, RETRY_MS);
+    }
+  });
+}
+
+function store(result, startedAt) {
+  var cache = {
+    celsius: result.celsius,
+    condition: result.condition,
+    fetchedAt: startedAt
+  };
+  writeJSON(CACHE_KEY, cache);
+  push(cache, 1);
+}
+
+function fetchFromProvider() {
+  var provider = getProvider();
+  // Stamp the cache with the start of the request so the next timer tick
+  // finds it expired instead of a few seconds short of the TTL
+  var startedAt = Date.now();
+  var done = function(err, result) {
+    if (err) {
+      console.log('Weather fetch failed: ' + err.message);
+      return;
+    }
+    store(result, startedAt);
+  };
+
+  if (!provider.needsLocation) {
+    provider.fetch(null, done);
+    return;
+  }
+
+  navigator.geolocation.getCurrentPosition(function(pos) {
+    provider.fetch(pos.coords, done);
+  }, function(err) {
+    console.log('Weather location failed: ' + err.message);
+  }, { timeout: 15000, maximumAge: TTL_MS });
+}
+
+function refresh() {
+  if (!readSettings().SHOW_WEATHER) {
+    return;
+  }
+
+  var cache = readJSON(CACHE_KEY);
+  if (cache && Date.now() - cache.fetchedAt < TTL_MS - MARGIN_MS) {
+    push(cache, 1);
+    return;
+  }
+  fetchFromProvider();
+}
+
+// Refresh now and then once per TTL; cached values are served in between
+function start() {
+  if (s_timer) {
+    clearInterval(s_timer);
+  }
+  refresh();
+  s_timer = setInterval(refresh, TTL_MS);
+}
+
+module.exports = {
+  start: start,
+  refresh: refresh
+};